@@ -41,6 +41,9 @@ void notifyStatus()
     s += "|KEY:";   s += deviceKey;
     s += "|MODE:";  s += String(displayMode);
     s += "|INT:";   s += String(refreshInterval / 1000);
+    s += "|RADIO:"; s += String(radioPolicy);
+    s += "|ON:";    s += String(radioOnMs);          // last cycle, ms
+    s += "|MAH:";   s += String(radioMah, 4);        // last cycle, estimate
 
     pCharStat->setValue(s.c_str());
     pCharStat->notify();
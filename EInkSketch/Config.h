@@ -10,6 +10,7 @@
 
 // ── Debug logging — comment out to strip all Serial output from flash ────────
 // #define DEBUG
+// #define DUMP_FRAMES   // with DEBUG: hex-dump each composed frame for test/ghost_replay
 
 #ifdef DEBUG
   #define DBG_PRINT(x)       Serial.print(x)
@@ -34,9 +35,7 @@
 #define DISPLAY_RST   6   // Reset
 #define DISPLAY_BUSY  7   // Busy signal
 
-constexpr uint16_t DISP_W  = 296;
-constexpr uint16_t DISP_H  = 128;
-constexpr size_t   BMP_SZ  = DISP_W * DISP_H / 8;  // 4736 bytes
+#include "Panel.h"   // DISP_W / DISP_H / BMP_SZ + ghosting limits
 
 // ══════════════════════════════════════════════════════════════════════════════
 // BLE UUIDs — Must match web app (public/js/app.js)
@@ -59,7 +58,13 @@ constexpr size_t   BMP_SZ  = DISP_W * DISP_H / 8;  // 4736 bytes
 #define STREAM_TIMEOUT_MS   30000
 #define MIN_INTERVAL_MS     10000
 #define STATIC_CHECK_MS     300000   // 5 min check for static modes
-#define FULL_REFRESH_EVERY  5        // full e-ink refresh every N frames
+#define WIFI_FAST_TIMEOUT_MS 4000    // cached BSSID/channel connect attempt
+
+// ══════════════════════════════════════════════════════════════════════════════
+// RADIO POWER POLICY — what WiFi does between fetches (X-Radio-Policy header)
+// ══════════════════════════════════════════════════════════════════════════════
+
+#include "RadioCycle.h"   // RadioPolicy enum + current estimates
 
 // ══════════════════════════════════════════════════════════════════════════════
 // NVS NAMESPACE & KEYS
@@ -75,6 +80,9 @@ constexpr size_t   BMP_SZ  = DISP_W * DISP_H / 8;  // 4736 bytes
 #define NVS_MODE     "mode"
 #define NVS_INTERVAL "intv"
 #define NVS_HAS_CACHE "cached"
+#define NVS_RADIO    "radio"
+#define NVS_FC_BSSID "fcbssid"
+#define NVS_FC_CHAN  "fcchan"
 
 // ══════════════════════════════════════════════════════════════════════════════
 // SHARED STATE  (defined in EInkSketch.ino, extern everywhere else)
@@ -101,6 +109,11 @@ extern uint32_t lastFetch;
 extern bool     wifiOk;
 extern bool     hasCachedFrame;
 
+// Radio duty cycling (last completed cycle, reported over BLE)
+extern uint8_t  radioPolicy;
+extern uint32_t radioOnMs;
+extern float    radioMah;
+
 // BLE flags
 extern bool bleConnected;
 extern bool pendingRefresh;
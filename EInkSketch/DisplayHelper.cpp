@@ -1,10 +1,28 @@
 /*
  * DisplayHelper.cpp — E-ink rendering helpers
  * ────────────────────────────────────────────────
+ * Frames are composed off-screen first so Ghosting.cpp can diff them
+ * against what the panel currently shows and pick skip / partial / full.
  */
 
 #include "DisplayHelper.h"
+#include "Ghosting.h"
 #include <SPI.h>
+#include <Adafruit_GFX.h>
+
+// Composed frame, 1 = white (same bit sense as GxEPD_WHITE / GxEPD_BLACK)
+static GFXcanvas1 frameCanvas(DISP_W, DISP_H);
+
+#if defined(DEBUG) && defined(DUMP_FRAMES)
+// One "[FRAME] <hex>" line per composed frame — input for test/ghost_replay
+static void dumpFrame(const uint8_t *buf)
+{
+    Serial.print("[FRAME] ");
+    for (size_t i = 0; i < BMP_SZ; i++)
+        Serial.printf("%02x", buf[i]);
+    Serial.println();
+}
+#endif
 
 // ── Hardware init ───────────────────────────────────────────────────────────
 
@@ -23,6 +41,7 @@ void initDisplay()
 
 void showMsg(const char *a, const char *b)
 {
+    ghostInvalidate();
     display.setFullWindow();
     display.fillScreen(GxEPD_WHITE);
     display.setTextColor(GxEPD_BLACK);
@@ -39,13 +58,13 @@ void showMsg(const char *a, const char *b)
 
 // ── Word-wrapped quote in bottom strip ──────────────────────────────────────
 
-void drawQuote(const char *txt)
+void drawQuote(Adafruit_GFX &g, const char *txt)
 {
     const uint16_t y0 = DISP_H - 36;
-    display.fillRect(0, y0, DISP_W, 36, GxEPD_WHITE);
-    display.drawLine(0, y0, DISP_W, y0, GxEPD_BLACK);
-    display.setTextColor(GxEPD_BLACK);
-    display.setTextSize(1);
+    g.fillRect(0, y0, DISP_W, 36, GxEPD_WHITE);
+    g.drawLine(0, y0, DISP_W, y0, GxEPD_BLACK);
+    g.setTextColor(GxEPD_BLACK);
+    g.setTextSize(1);
 
     uint16_t cy  = y0 + 11;
     uint8_t  col = 0, ln = 0;
@@ -64,9 +83,9 @@ void drawQuote(const char *txt)
         }
 
         if (col) col++;
-        display.setCursor(3 + col * 6, cy);
+        g.setCursor(3 + col * 6, cy);
         for (uint8_t i = 0; i < wl && total < 144; i++, total++)
-            display.print(p[i]);
+            g.print(p[i]);
 
         col += wl;
         p += wl;
@@ -78,24 +97,51 @@ void drawQuote(const char *txt)
 
 void showFrame()
 {
-    display.setFullWindow();
-    display.fillScreen(GxEPD_WHITE);
-    display.drawBitmap(0, 0, imgBuf, DISP_W, DISP_H, GxEPD_BLACK);
+    frameCanvas.fillScreen(GxEPD_WHITE);
+    frameCanvas.drawBitmap(0, 0, imgBuf, DISP_W, DISP_H, GxEPD_BLACK);
 
     if (quoteBuf[0])
-        drawQuote(quoteBuf);
+        drawQuote(frameCanvas, quoteBuf);
+
+    const uint8_t *next = frameCanvas.getBuffer();
+#if defined(DEBUG) && defined(DUMP_FRAMES)
+    dumpFrame(next);
+#endif
+
+    GhostRefresh r = ghostPlan(next);
+    if (r == GHOST_SKIP)
+    {
+        DBG_PRINTLN("[DISP] Frame unchanged — no refresh");
+        return;
+    }
+
+    display.setFullWindow();
+    display.drawBitmap(0, 0, next, DISP_W, DISP_H, GxEPD_WHITE, GxEPD_BLACK);
+
+    uint32_t t = millis();
+    display.display(r == GHOST_PARTIAL);
+    ghostCommit(next, r);
 
-    // Full hardware refresh every N frames to reduce ghosting
-    bool partial = (frameNum % FULL_REFRESH_EVERY != 0);
-    display.display(partial);
     frameNum++;
-    DBG_PRINTF("[DISP] Frame #%u rendered\n", frameNum);
+    DBG_PRINTF("[DISP] Frame #%u rendered (%s, %lu ms)\n",
+                  frameNum, r == GHOST_FULL ? "full" : "partial", millis() - t);
+}
+
+// ── Blank the panel ─────────────────────────────────────────────────────────
+
+void clearScreen()
+{
+    ghostInvalidate();
+    display.setFullWindow();
+    display.fillScreen(GxEPD_WHITE);
+    display.display(false);
 }
 
 // ── First-boot / no config screen ───────────────────────────────────────────
 
 void showSetupScreen()
 {
+    ghostInvalidate();
     display.setFullWindow();
     display.fillScreen(GxEPD_WHITE);
     display.setTextColor(GxEPD_BLACK);
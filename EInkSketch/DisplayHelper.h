@@ -8,6 +8,7 @@
 
 void initDisplay();
 void showMsg(const char *a, const char *b = nullptr);
-void drawQuote(const char *txt);
+void drawQuote(Adafruit_GFX &g, const char *txt);
 void showFrame();          // Render imgBuf + quoteBuf to display
+void clearScreen();
 void showSetupScreen();    // "Connect via BLE" first-boot screen
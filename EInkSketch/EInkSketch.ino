@@ -16,7 +16,9 @@
  *    • BLE REFRESH cmd — immediate fetch
  *    • BLE CONNECT cmd — reconnect WiFi
  *
- *  WiFi is used ONLY for internet (API calls).
+ *  WiFi is used ONLY for internet (API calls) and is duty-cycled:
+ *  after each fetch it stays on, modem-sleeps, or powers off per the
+ *  server's radio policy, and is brought back up when the next is due.
  *  All configuration is done via BLE from the web app.
  */
 
@@ -25,6 +27,7 @@
 #include "BleHandler.h"
 #include "DisplayHelper.h"
 #include "WifiApi.h"
+#include "RadioPolicy.h"
 
 // ══════════════════════════════════════════════════════════════════════════════
 // GLOBAL STATE  (declared extern in Config.h)
@@ -48,6 +51,10 @@ uint32_t lastFetch       = 0;
 bool     wifiOk          = false;
 bool     hasCachedFrame  = false;
 
+uint8_t  radioPolicy     = RADIO_ON;
+uint32_t radioOnMs       = 0;
+float    radioMah        = 0;
+
 bool     bleConnected      = false;
 bool     pendingRefresh    = false;
 bool     pendingWifiConnect = false;
@@ -87,7 +94,7 @@ void setup()
         if (!hasCachedFrame)
             showMsg("Connecting...", wifiSsid);
 
-        wifiOk = connectWifi();
+        wifiOk = radioWake();
 
         if (wifiOk && strlen(serverUrl) > 0 && strlen(deviceKey) > 0)
         {
@@ -105,6 +112,7 @@ void setup()
         {
             showMsg("WiFi failed", "Connect via BLE to fix");
         }
+        radioSleep();
     }
     else if (!hasCachedFrame)
     {
@@ -124,8 +132,9 @@ void loop()
     {
         pendingWifiConnect = false;
         DBG_PRINTLN("[CMD] WiFi reconnect");
-        wifiOk = connectWifi();
+        wifiOk = radioWake(true);
         notifyStatus();
+        radioSleep(false);   // not a scheduled cycle
     }
 
     // ── Handle BLE CLEAR command ────────────────────────────────────────────
@@ -133,9 +142,7 @@ void loop()
     {
         pendingClear = false;
         DBG_PRINTLN("[CMD] Clear screen via BLE");
-        display.setFullWindow();
-        display.fillScreen(GxEPD_WHITE);
-        display.display(false);
+        clearScreen();
         DBG_PRINTLN("[DISP] Screen cleared");
     }
 
@@ -145,37 +152,39 @@ void loop()
         pendingRefresh = false;
         DBG_PRINTLN("[CMD] Refresh via BLE");
 
-        if (WiFi.status() != WL_CONNECTED)
-            wifiOk = connectWifi();
+        wifiOk = radioWake();
 
-        if (wifiOk && fetchFrame())
-        {
+        bool ok = wifiOk && fetchFrame();
+        notifyStatus();
+        radioSleep(false);   // not a scheduled cycle
+
+        if (ok)
             showFrame();
-            notifyStatus();
-        }
         else
-        {
             showMsg("Refresh failed", wifiOk ? "API error" : "No WiFi");
-            notifyStatus();
-        }
+
         lastFetch = millis();
     }
 
     // ── Auto-refresh timer ──────────────────────────────────────────────────
-    bool canFetch = wifiOk && strlen(serverUrl) > 0 && strlen(deviceKey) > 0;
+    // The radio is usually down here, so don't gate on wifiOk — a failed
+    // wake retries later, backing off up to STATIC_CHECK_MS.
+    bool canFetch = strlen(wifiSsid) > 0 && strlen(serverUrl) > 0 && strlen(deviceKey) > 0;
 
     // Mode 0 = auto at interval.  Modes 1,2 = check every 5 min for changes.
     uint32_t interval = (displayMode == 0)
                             ? refreshInterval
                             : max(refreshInterval, (uint32_t)STATIC_CHECK_MS);
 
-    if (canFetch && millis() - lastFetch >= interval)
+    if (canFetch && millis() - lastFetch >= radioNextWake(interval))
     {
-        // Reconnect if WiFi dropped
-        if (WiFi.status() != WL_CONNECTED)
-            wifiOk = connectWifi();
+        // One (fast-)connect attempt per deadline
+        wifiOk = radioWake();
+
+        bool ok = wifiOk && fetchFrame();
+        radioSleep();   // radio is done before the slow e-ink refresh
 
-        if (wifiOk && fetchFrame())
+        if (ok)
             showFrame();
 
         lastFetch = millis();
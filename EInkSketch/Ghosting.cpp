@@ -0,0 +1,92 @@
+/*
+ * Ghosting.cpp — Partial vs full refresh scheduling from pixel-flip counts
+ * ────────────────────────────────────────────────
+ * Partial refreshes are used until a tile has accumulated GHOST_REPAINT_PCT %
+ * of its area in pixel flips (or GHOST_MAX_PARTIALS partials have run), then
+ * one full refresh clears the ghosting.
+ */
+
+#include "Ghosting.h"
+
+#include <string.h>
+
+// What the panel shows now + partial-refresh flips per tile since last full
+static uint8_t  shownBuf[BMP_SZ];
+static bool     shownValid   = false;
+static uint16_t ghostFlips[GHOST_TILES];
+static uint16_t pendingFlips[GHOST_TILES];   // from the last ghostPlan()
+static uint8_t  partialCount = 0;
+
+void ghostInvalidate()
+{
+    shownValid = false;
+}
+
+// Pixel area of tile t (right / bottom edge tiles may be smaller)
+static uint32_t tileArea(uint16_t t)
+{
+    uint16_t x0 = (t % GHOST_COLS) * GHOST_TILE_PX;
+    uint16_t y0 = (t / GHOST_COLS) * GHOST_TILE_PX;
+    uint16_t w  = (DISP_W - x0 < GHOST_TILE_PX) ? DISP_W - x0 : GHOST_TILE_PX;
+    uint16_t h  = (DISP_H - y0 < GHOST_TILE_PX) ? DISP_H - y0 : GHOST_TILE_PX;
+    return (uint32_t)w * h;
+}
+
+// ── Count pixel flips between shownBuf and next into pendingFlips ───────────
+
+static uint32_t countFlips(const uint8_t *next)
+{
+    constexpr uint16_t ROW_BYTES = DISP_W / 8;
+    uint32_t total = 0;
+
+    memset(pendingFlips, 0, sizeof(pendingFlips));
+    for (size_t i = 0; i < BMP_SZ; i++)
+    {
+        uint8_t d = next[i] ^ shownBuf[i];
+        if (!d) continue;
+
+        uint8_t  n = __builtin_popcount(d);
+        uint16_t x = (i % ROW_BYTES) * 8;
+        uint16_t y = i / ROW_BYTES;
+        pendingFlips[(y / GHOST_TILE_PX) * GHOST_COLS + x / GHOST_TILE_PX] += n;
+        total += n;
+    }
+    return total;
+}
+
+GhostRefresh ghostPlan(const uint8_t *next)
+{
+    if (!shownValid)
+        return GHOST_FULL;
+    if (countFlips(next) == 0)
+        return GHOST_SKIP;
+    if (partialCount >= GHOST_MAX_PARTIALS)
+        return GHOST_FULL;
+
+    for (uint16_t t = 0; t < GHOST_TILES; t++)
+    {
+        uint32_t flips = ghostFlips[t] + pendingFlips[t];
+        if (flips * 100 >= tileArea(t) * GHOST_REPAINT_PCT)
+            return GHOST_FULL;
+    }
+    return GHOST_PARTIAL;
+}
+
+void ghostCommit(const uint8_t *next, GhostRefresh r)
+{
+    if (r == GHOST_SKIP) return;
+
+    if (r == GHOST_FULL)
+    {
+        memset(ghostFlips, 0, sizeof(ghostFlips));
+        partialCount = 0;
+    }
+    else
+    {
+        for (uint16_t t = 0; t < GHOST_TILES; t++)
+            ghostFlips[t] += pendingFlips[t];
+        partialCount++;
+    }
+    memcpy(shownBuf, next, BMP_SZ);
+    shownValid = true;
+}
@@ -0,0 +1,20 @@
+/*
+ * Ghosting.h — Partial vs full refresh scheduling from pixel-flip counts
+ * ────────────────────────────────────────────────
+ * Frames are packed 1-bit DISP_W × DISP_H rows, MSB first; bit polarity
+ * doesn't matter, only changes are counted.
+ */
+#pragma once
+
+#include "Panel.h"
+
+enum GhostRefresh : uint8_t
+{
+    GHOST_SKIP    = 0,   // identical to what the panel shows
+    GHOST_PARTIAL = 1,
+    GHOST_FULL    = 2,
+};
+
+void         ghostInvalidate();                  // Panel contents unknown
+GhostRefresh ghostPlan(const uint8_t *next);     // Decide, no state change
+void         ghostCommit(const uint8_t *next, GhostRefresh r);  // After refresh
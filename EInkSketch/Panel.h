@@ -0,0 +1,26 @@
+/*
+ * Panel.h — Panel geometry + ghosting limits
+ * ────────────────────────────────────────────────
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr uint16_t DISP_W  = 296;
+constexpr uint16_t DISP_H  = 128;
+constexpr size_t   BMP_SZ  = DISP_W * DISP_H / 8;  // 4736 bytes
+
+// ── Ghosting limits — conservative defaults, raise only after checking a panel ─
+// Pixel flips done by partial refreshes are counted per tile; once any tile
+// has been repainted GHOST_REPAINT_PCT % of its own area (edge tiles are
+// smaller), or GHOST_MAX_PARTIALS partials have run, the next frame is full.
+constexpr uint16_t GHOST_TILE_PX      = 32;    // tile edge, multiple of 8
+constexpr uint16_t GHOST_REPAINT_PCT  = 150;   // ~1.5 full repaints of a tile
+constexpr uint8_t  GHOST_MAX_PARTIALS = 10;    // max age since last full refresh
+
+constexpr uint16_t GHOST_COLS  = (DISP_W + GHOST_TILE_PX - 1) / GHOST_TILE_PX;
+constexpr uint16_t GHOST_ROWS  = (DISP_H + GHOST_TILE_PX - 1) / GHOST_TILE_PX;
+constexpr uint16_t GHOST_TILES = GHOST_COLS * GHOST_ROWS;
+
+static_assert(GHOST_TILE_PX % 8 == 0, "ghost tiles must be byte-aligned");
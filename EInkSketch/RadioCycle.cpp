@@ -0,0 +1,61 @@
+/*
+ * RadioCycle.cpp — Radio duty-cycle state machine + energy estimate
+ * ────────────────────────────────────────────────
+ */
+
+#include "RadioCycle.h"
+
+float radioRestMa(uint8_t policy)
+{
+    switch (policy)
+    {
+    case RADIO_ON:   return RADIO_IDLE_MA;
+    case RADIO_DOZE: return RADIO_DOZE_MA;
+    default:         return 0.0f;
+    }
+}
+
+bool radioCycleWake(RadioCycle &c, uint32_t now, bool connected, bool reconnect)
+{
+    if (!c.awake)
+    {
+        c.restCharge += (now - c.restAt) * radioRestMa(c.restPolicy);
+        c.wakeAt = now;
+        c.awake  = true;
+    }
+    return reconnect || !connected;
+}
+
+void radioCycleConnected(RadioCycle &c, bool ok, bool reconnect)
+{
+    if (ok || reconnect)
+        c.failStreak = 0;
+    else if (c.failStreak < 255)
+        c.failStreak++;
+}
+
+uint32_t radioCycleDelay(const RadioCycle &c, uint32_t interval, uint32_t cap)
+{
+    uint32_t d = interval;
+    for (uint8_t i = 0; i < c.failStreak && d < cap; i++)
+        d = (d > cap / 2) ? cap : d * 2;
+    return d > interval ? d : interval;
+}
+
+bool radioCycleSleep(RadioCycle &c, uint32_t now, uint8_t policy, bool endCycle)
+{
+    if (!c.awake) return false;
+
+    c.onMs      += now - c.wakeAt;
+    c.awake      = false;
+    c.restAt     = now;
+    c.restPolicy = policy;
+
+    if (!endCycle) return false;
+
+    c.lastOnMs   = c.onMs;
+    c.lastMah    = (c.onMs * RADIO_ACTIVE_MA + c.restCharge) / 3600000.0f;
+    c.onMs       = 0;
+    c.restCharge = 0;
+    return true;
+}
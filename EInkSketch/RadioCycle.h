@@ -0,0 +1,59 @@
+/*
+ * RadioCycle.h — Radio duty-cycle state machine + energy estimate
+ * ────────────────────────────────────────────────
+ * RadioPolicy.cpp drives it with millis() and does the actual WiFi calls.
+ */
+#pragma once
+
+#include <stdint.h>
+
+enum RadioPolicy : uint8_t
+{
+    RADIO_ON   = 0,   // stay associated, default power save (legacy behaviour)
+    RADIO_DOZE = 1,   // stay associated in max modem-sleep
+    RADIO_OFF  = 2,   // disconnect + radio off, fast-connect on next wake
+};
+
+// Rough radio current draw (mA) used for the per-cycle mAh estimate
+#define RADIO_ACTIVE_MA     80.0f    // fetching
+#define RADIO_IDLE_MA       30.0f    // associated, WIFI_PS_MIN_MODEM
+#define RADIO_DOZE_MA       15.0f    // associated, WIFI_PS_MAX_MODEM
+
+/**
+ * A cycle runs from one scheduled sleep to the next.  Command-triggered
+ * wakes (BLE REFRESH / CONNECT) fold their on-time into the open cycle
+ * instead of closing it.
+ *
+ *   mAh = (awake_ms × RADIO_ACTIVE_MA + Σ rest_ms × rest_mA) / 3.6e6
+ */
+struct RadioCycle
+{
+    bool     awake      = false;
+    uint32_t wakeAt     = 0;          // start of the current awake span
+    uint32_t restAt     = 0;          // start of the current rest span
+    uint8_t  restPolicy = RADIO_OFF;  // policy in force while resting
+    uint32_t onMs       = 0;          // awake time so far this cycle
+    float    restCharge = 0;          // mA·ms spent resting so far this cycle
+
+    uint32_t lastOnMs   = 0;          // last completed cycle
+    float    lastMah    = 0;
+
+    uint8_t  failStreak = 0;          // consecutive failed connects
+};
+
+float radioRestMa(uint8_t policy);
+
+// Start an awake span.  Returns true if the caller must (re)connect WiFi.
+bool radioCycleWake(RadioCycle &c, uint32_t now, bool connected, bool reconnect);
+
+// Record a connect attempt: success clears the failure streak.
+// A forced reconnect (BLE CONNECT) clears it whatever the outcome.
+void radioCycleConnected(RadioCycle &c, bool ok, bool reconnect);
+
+// Delay before the next scheduled wake: `interval`, doubled per failed
+// connect in a row, capped at max(interval, cap).
+uint32_t radioCycleDelay(const RadioCycle &c, uint32_t interval, uint32_t cap);
+
+// End an awake span and rest under `policy`.  With endCycle the cycle is
+// closed into lastOnMs / lastMah and true is returned.
+bool radioCycleSleep(RadioCycle &c, uint32_t now, uint8_t policy, bool endCycle);
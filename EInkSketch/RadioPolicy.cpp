@@ -0,0 +1,68 @@
+/*
+ * RadioPolicy.cpp — WiFi duty cycling between frame fetches
+ * ────────────────────────────────────────────────
+ * The radio is only needed for the few seconds around fetchFrame().
+ * After each fetch radioSleep() applies the server-chosen radioPolicy
+ * (stay on / modem-sleep / off) and radioWake() brings it back when the
+ * next fetch is due.  Cycle bookkeeping lives in RadioCycle.cpp.
+ */
+
+#include "RadioPolicy.h"
+#include "WifiApi.h"
+
+#include <WiFi.h>
+
+static RadioCycle cycle;
+
+// ── Bring WiFi up (fast-connect when it was switched off) ──────────────────
+
+bool radioWake(bool reconnect)
+{
+    if (!cycle.awake && cycle.restPolicy == RADIO_DOZE)
+        WiFi.setSleep(WIFI_PS_MIN_MODEM);
+
+    if (radioCycleWake(cycle, millis(), WiFi.status() == WL_CONNECTED, reconnect))
+    {
+        wifiOk = connectWifi();
+        radioCycleConnected(cycle, wifiOk, reconnect);
+    }
+
+    return wifiOk;
+}
+
+// ── Back off scheduled wakes while the AP is unreachable ────────────────────
+
+uint32_t radioNextWake(uint32_t interval)
+{
+    return radioCycleDelay(cycle, interval, STATIC_CHECK_MS);
+}
+
+// ── Done with the radio: power it down per policy ───────────────────────────
+
+void radioSleep(bool endCycle)
+{
+    if (!cycle.awake) return;
+
+    if (radioCycleSleep(cycle, millis(), radioPolicy, endCycle))
+    {
+        radioOnMs = cycle.lastOnMs;
+        radioMah  = cycle.lastMah;
+        DBG_PRINTF("[RADIO] Cycle: on=%lu ms  ~%.4f mAh  policy=%u\n",
+                      radioOnMs, radioMah, radioPolicy);
+    }
+
+    switch (radioPolicy)
+    {
+    case RADIO_ON:
+        break;
+
+    case RADIO_DOZE:
+        WiFi.setSleep(WIFI_PS_MAX_MODEM);
+        break;
+
+    default:
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
+        break;
+    }
+}
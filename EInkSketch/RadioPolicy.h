@@ -0,0 +1,11 @@
+/*
+ * RadioPolicy.h — WiFi duty cycling between frame fetches
+ * ────────────────────────────────────────────────
+ */
+#pragma once
+
+#include "Config.h"
+
+bool radioWake(bool reconnect = false);   // Bring WiFi up, returns wifiOk
+void radioSleep(bool endCycle = true);    // Apply radioPolicy (+ close the cycle)
+uint32_t radioNextWake(uint32_t interval); // interval, backed off after failures
@@ -3,6 +3,7 @@
  * ────────────────────────────────────────────────
  * Stores WiFi creds, server URL, device key, and the last rendered
  * frame (bitmap + quote) so it can display instantly on boot.
+ * Also keeps the last AP's BSSID + channel for fast WiFi reconnects.
  */
 
 #include "Storage.h"
@@ -34,6 +35,8 @@ void saveCredentials()
     prefs.putString(NVS_PASS, wifiPass);
     prefs.putString(NVS_SRV,  serverUrl);
     prefs.putString(NVS_KEY,  deviceKey);
+    prefs.remove(NVS_FC_BSSID);   // creds changed → cached AP may be wrong
+    prefs.remove(NVS_FC_CHAN);
     prefs.end();
     DBG_PRINTLN("[NVS] Credentials saved");
 }
@@ -58,8 +61,9 @@ void loadCachedFrame()
             strlcpy(quoteBuf, prefs.getString(NVS_QUOTE, "").c_str(), sizeof(quoteBuf));
             displayMode     = prefs.getUChar(NVS_MODE, 0);
             refreshInterval = prefs.getULong(NVS_INTERVAL, 60000);
-            DBG_PRINTF("[NVS] Cached frame loaded (mode=%u, interval=%lu)\n",
-                          displayMode, refreshInterval);
+            radioPolicy     = prefs.getUChar(NVS_RADIO, RADIO_ON);
+            DBG_PRINTF("[NVS] Cached frame loaded (mode=%u, interval=%lu, radio=%u)\n",
+                          displayMode, refreshInterval, radioPolicy);
         }
     }
     else
@@ -78,9 +82,30 @@ void saveCachedFrame()
     prefs.putString(NVS_QUOTE, quoteBuf);
     prefs.putUChar(NVS_MODE, displayMode);
     prefs.putULong(NVS_INTERVAL, refreshInterval);
+    prefs.putUChar(NVS_RADIO, radioPolicy);
     prefs.putBool(NVS_HAS_CACHE, true);
     prefs.end();
 
     hasCachedFrame = true;
     DBG_PRINTLN("[NVS] Frame cached");
 }
+
+// ── Fast-connect profile (BSSID + channel of the last successful AP) ───────
+
+bool loadFastConnect(uint8_t bssid[6], int32_t &channel)
+{
+    prefs.begin(NVS_NS, true);
+    channel = prefs.getInt(NVS_FC_CHAN, 0);
+    bool ok = channel > 0 && prefs.getBytes(NVS_FC_BSSID, bssid, 6) == 6;
+    prefs.end();
+    return ok;
+}
+
+void saveFastConnect(const uint8_t bssid[6], int32_t channel)
+{
+    prefs.begin(NVS_NS, false);
+    prefs.putBytes(NVS_FC_BSSID, bssid, 6);
+    prefs.putInt(NVS_FC_CHAN, channel);
+    prefs.end();
+    DBG_PRINTF("[NVS] Fast-connect saved (ch=%d)\n", channel);
+}
@@ -10,3 +10,5 @@ void loadCredentials();
 void saveCredentials();
 void loadCachedFrame();
 void saveCachedFrame();
+bool loadFastConnect(uint8_t bssid[6], int32_t &channel);
+void saveFastConnect(const uint8_t bssid[6], int32_t channel);
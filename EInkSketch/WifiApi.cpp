@@ -15,6 +15,24 @@
 // WIFI CONNECTION
 // ══════════════════════════════════════════════════════════════════════════════
 
+// Block until associated or timeout
+static bool waitWifi(uint32_t timeoutMs)
+{
+    uint32_t t = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - t < timeoutMs)
+    {
+        delay(100);
+        DBG_PRINT(".");
+    }
+    DBG_PRINTLN();
+    return WiFi.status() == WL_CONNECTED;
+}
+
+/**
+ * Tries the cached BSSID + channel first (skips the full scan, ~1 s instead
+ * of several), then falls back to a normal connect.  The AP actually joined
+ * is remembered for the next wake.
+ */
 bool connectWifi()
 {
     if (strlen(wifiSsid) == 0)
@@ -23,23 +41,39 @@ bool connectWifi()
         return false;
     }
 
-    DBG_PRINTF("[WiFi] Connecting to '%s'...\n", wifiSsid);
     WiFi.mode(WIFI_STA);
-    WiFi.begin(wifiSsid, wifiPass);
 
-    uint32_t t = millis();
-    while (WiFi.status() != WL_CONNECTED && millis() - t < WIFI_TIMEOUT_MS)
+    uint8_t bssid[6];
+    int32_t chan = 0;
+    bool    fast = loadFastConnect(bssid, chan);
+
+    wifiOk = false;
+    if (fast)
     {
-        delay(250);
-        DBG_PRINT(".");
+        DBG_PRINTF("[WiFi] Fast-connect to '%s' (ch=%d)", wifiSsid, chan);
+        WiFi.begin(wifiSsid, wifiPass, chan, bssid);
+        wifiOk = waitWifi(WIFI_FAST_TIMEOUT_MS);
+        if (!wifiOk)
+            WiFi.disconnect();
+    }
+
+    if (!wifiOk)
+    {
+        DBG_PRINTF("[WiFi] Connecting to '%s'...", wifiSsid);
+        WiFi.begin(wifiSsid, wifiPass);
+        wifiOk = waitWifi(WIFI_TIMEOUT_MS);
     }
-    DBG_PRINTLN();
 
-    wifiOk = (WiFi.status() == WL_CONNECTED);
     if (wifiOk)
+    {
         DBG_PRINTF("[WiFi] OK — %s\n", WiFi.localIP().toString().c_str());
+        if (!fast || chan != WiFi.channel() || memcmp(bssid, WiFi.BSSID(), 6) != 0)
+            saveFastConnect(WiFi.BSSID(), WiFi.channel());
+    }
     else
+    {
         DBG_PRINTLN("[WiFi] Failed");
+    }
 
     return wifiOk;
 }
@@ -51,9 +85,9 @@ bool connectWifi()
 /**
  * GET /api/frame?key=DEVICE_KEY
  * Response: [4736 bytes bitmap][quote UTF-8 text]
- * Headers:  X-Display-Mode, X-Duration (seconds)
+ * Headers:  X-Display-Mode, X-Duration (seconds), X-Radio-Policy
  *
- * On success: fills imgBuf, quoteBuf, displayMode, refreshInterval
+ * On success: fills imgBuf, quoteBuf, displayMode, refreshInterval, radioPolicy
  *             and caches everything to NVS for next boot.
  */
 bool fetchFrame()
@@ -76,8 +110,8 @@ bool fetchFrame()
 
     http.setTimeout(HTTP_TIMEOUT_MS);
 
-    const char *hdrs[] = {"X-Display-Mode", "X-Duration"};
-    http.collectHeaders(hdrs, 2);
+    const char *hdrs[] = {"X-Display-Mode", "X-Duration", "X-Radio-Policy"};
+    http.collectHeaders(hdrs, 3);
 
     int code = http.GET();
     if (code != 200)
@@ -93,6 +127,9 @@ bool fetchFrame()
     if (http.hasHeader("X-Duration"))
         refreshInterval = max((uint32_t)MIN_INTERVAL_MS,
                               (uint32_t)http.header("X-Duration").toInt() * 1000);
+    if (http.hasHeader("X-Radio-Policy"))
+        radioPolicy = constrain(http.header("X-Radio-Policy").toInt(),
+                                (long)RADIO_ON, (long)RADIO_OFF);
 
     WiFiClient *stream = http.getStreamPtr();
 
@@ -136,8 +173,8 @@ bool fetchFrame()
     quoteBuf[q] = '\0';
 
     http.end();
-    DBG_PRINTF("[API] OK: %u bmp + %u quote  mode=%u  int=%lu\n",
-                  n, q, displayMode, refreshInterval);
+    DBG_PRINTF("[API] OK: %u bmp + %u quote  mode=%u  int=%lu  radio=%u\n",
+                  n, q, displayMode, refreshInterval, radioPolicy);
 
     // ── Cache to NVS so next boot shows instantly ───────────────────────────
     saveCachedFrame();
@@ -0,0 +1,32 @@
+/*
+ * check.h — Minimal assertion helpers for the host tests
+ * ────────────────────────────────────────────────
+ */
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+
+static int checkFailures = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            checkFailures++;                                                \
+        }                                                                   \
+    } while (0)
+
+#define CHECK_NEAR(a, b) CHECK(std::fabs((a) - (b)) < 1e-6f)
+
+// main() epilogue: report and turn failures into the exit code
+inline int checkSummary(const char *suite)
+{
+    if (checkFailures)
+    {
+        std::printf("%s: %d check(s) failed\n", suite, checkFailures);
+        return 1;
+    }
+    std::printf("%s: all checks passed\n", suite);
+    return 0;
+}
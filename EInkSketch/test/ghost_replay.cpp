@@ -0,0 +1,91 @@
+/*
+ * ghost_replay.cpp — Replay recorded frames, report refresh-time totals
+ * ────────────────────────────────────────────────
+ * Usage: ghost_replay LOG...
+ *   Build the sketch with DEBUG + DUMP_FRAMES and capture the serial
+ *   output: showFrame() prints one "[FRAME] <9472 hex chars>" line per
+ *   composed frame (bitmap with the quote strip drawn over it), which is
+ *   exactly what Ghosting.cpp diffs on the device.  Other log lines are
+ *   ignored; logs are concatenated in argument order into one sequence.
+ */
+
+#include "ghost_sim.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+static const char FRAME_TAG[] = "[FRAME] ";
+
+static int hexNibble(char ch)
+{
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+// Append the frame on `line` to `frames`; false if it isn't a full dump
+static bool parseFrame(const std::string &line, std::vector<uint8_t> &frames)
+{
+    size_t at = line.find(FRAME_TAG);
+    if (at == std::string::npos) return false;
+
+    const char *hex = line.c_str() + at + strlen(FRAME_TAG);
+    if (strlen(hex) < 2 * BMP_SZ) return false;
+
+    uint8_t buf[BMP_SZ];
+    for (size_t i = 0; i < BMP_SZ; i++)
+    {
+        int hi = hexNibble(hex[2 * i]), lo = hexNibble(hex[2 * i + 1]);
+        if (hi < 0 || lo < 0) return false;
+        buf[i] = (uint8_t)(hi << 4 | lo);
+    }
+    frames.insert(frames.end(), buf, buf + BMP_SZ);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s LOG...  (serial output of a DUMP_FRAMES build)\n",
+                     argv[0]);
+        return 2;
+    }
+
+    std::vector<uint8_t> frames;
+    size_t bad = 0;
+    for (int a = 1; a < argc; a++)
+    {
+        std::ifstream in(argv[a]);
+        if (!in)
+        {
+            std::fprintf(stderr, "cannot open %s\n", argv[a]);
+            return 1;
+        }
+        std::string line;
+        while (std::getline(in, line))
+            if (line.find(FRAME_TAG) != std::string::npos && !parseFrame(line, frames))
+                bad++;
+    }
+
+    if (bad)
+        std::fprintf(stderr, "skipped %zu truncated/garbled [FRAME] line(s)\n", bad);
+    if (frames.empty())
+    {
+        std::fprintf(stderr, "no [FRAME] dumps found\n");
+        return 1;
+    }
+
+    ReplayTotals t = replayFrames(frames);
+    std::printf("frames          %zu\n", frames.size() / BMP_SZ);
+    std::printf("ghosting-aware  full=%u partial=%u skipped=%u  ~%u ms\n",
+                t.full, t.partial, t.skipped, t.ms());
+    std::printf("every-%u rule    full=%u partial=%u skipped=0  ~%u ms\n",
+                OLD_FULL_EVERY, t.oldFull, t.oldPartial, t.oldMs());
+    if (t.oldMs())
+        std::printf("refresh time    %.1f %% of old\n", 100.0 * t.ms() / t.oldMs());
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * ghost_sim.h — Replay a frame sequence through Ghosting.cpp
+ * ────────────────────────────────────────────────
+ * Shared by ghost_replay (CLI) and test_ghosting.  Refresh times are
+ * rough GDEM029T94 figures, only used to compare schedules.
+ */
+#pragma once
+
+#include "Ghosting.h"
+
+#include <vector>
+
+constexpr uint32_t REFRESH_FULL_MS    = 2600;
+constexpr uint32_t REFRESH_PARTIAL_MS = 450;
+constexpr uint32_t OLD_FULL_EVERY     = 5;    // former FULL_REFRESH_EVERY
+
+struct ReplayTotals
+{
+    uint32_t full = 0, partial = 0, skipped = 0;
+    uint32_t oldFull = 0, oldPartial = 0;
+
+    uint32_t ms()    const { return full * REFRESH_FULL_MS + partial * REFRESH_PARTIAL_MS; }
+    uint32_t oldMs() const { return oldFull * REFRESH_FULL_MS + oldPartial * REFRESH_PARTIAL_MS; }
+};
+
+// Frames are BMP_SZ bytes each; the first one follows a boot (full refresh)
+inline ReplayTotals replayFrames(const std::vector<uint8_t> &frames,
+                                 std::vector<GhostRefresh> *trace = nullptr)
+{
+    ReplayTotals tot;
+    size_t count = frames.size() / BMP_SZ;
+
+    ghostInvalidate();
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *f = &frames[i * BMP_SZ];
+        GhostRefresh   r = ghostPlan(f);
+        ghostCommit(f, r);
+        if (trace) trace->push_back(r);
+
+        if (r == GHOST_FULL)         tot.full++;
+        else if (r == GHOST_PARTIAL) tot.partial++;
+        else                         tot.skipped++;
+
+        // Old rule: every frame refreshed, full on every OLD_FULL_EVERY-th
+        if (i % OLD_FULL_EVERY == 0) tot.oldFull++;
+        else                         tot.oldPartial++;
+    }
+    return tot;
+}
@@ -0,0 +1,128 @@
+/*
+ * test_ghosting.cpp — Refresh scheduling on synthetic frame sequences
+ * ────────────────────────────────────────────────
+ */
+
+#include "ghost_sim.h"
+#include "check.h"
+
+#include <cstring>
+
+constexpr uint16_t ROW_BYTES = DISP_W / 8;
+
+struct Frame
+{
+    uint8_t px[BMP_SZ];
+    Frame() { memset(px, 0, sizeof(px)); }
+
+    // Invert a byte-aligned rectangle (x, w multiples of 8)
+    void invert(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+        for (uint16_t r = y; r < y + h; r++)
+            for (uint16_t b = x / 8; b < (x + w) / 8; b++)
+                px[r * ROW_BYTES + b] ^= 0xFF;
+    }
+};
+
+static void append(std::vector<uint8_t> &seq, const Frame &f)
+{
+    seq.insert(seq.end(), f.px, f.px + BMP_SZ);
+}
+
+// ── Identical frames are skipped; boot frame is full ─────────────────────────
+
+static void testSkipUnchanged()
+{
+    std::vector<uint8_t> seq;
+    Frame f;
+    for (int i = 0; i < 10; i++) append(seq, f);
+
+    ReplayTotals t = replayFrames(seq);
+    CHECK(t.full == 1);
+    CHECK(t.partial == 0);
+    CHECK(t.skipped == 9);
+    CHECK(t.oldFull == 2 && t.oldPartial == 8);
+}
+
+// ── Small quote-strip edits stay partial until GHOST_MAX_PARTIALS ────────────
+
+static void testQuoteStripAge()
+{
+    std::vector<uint8_t> seq;
+    Frame f;
+    const int frames = 40;
+    static_assert(GHOST_MAX_PARTIALS + 1 < 40, "sequence must reach max age");
+
+    for (int i = 0; i < frames; i++)
+    {
+        // Toggle a different 8×8 glyph cell in the bottom strip each frame
+        f.invert((i % 36) * 8, DISP_H - 16, 8, 8);
+        append(seq, f);
+    }
+
+    std::vector<GhostRefresh> trace;
+    ReplayTotals t = replayFrames(seq, &trace);
+    CHECK(trace[0] == GHOST_FULL);
+    for (int i = 1; i <= GHOST_MAX_PARTIALS; i++)
+        CHECK(trace[i] == GHOST_PARTIAL);
+    CHECK(trace[GHOST_MAX_PARTIALS + 1] == GHOST_FULL);
+    CHECK(t.full == 1 + (frames - 1) / (GHOST_MAX_PARTIALS + 1));
+    CHECK(t.ms() < t.oldMs());
+}
+
+// ── Repeated big changes in one tile force a full refresh ────────────────────
+
+static void testTileThreshold()
+{
+    std::vector<uint8_t> seq;
+    Frame f;
+    append(seq, f);
+    f.invert(0, 0, 32, 32);  append(seq, f);   // 100 % of tile 0
+    f.invert(0, 0, 32, 32);  append(seq, f);   // 200 % → full
+
+    std::vector<GhostRefresh> trace;
+    replayFrames(seq, &trace);
+    CHECK(trace[1] == GHOST_PARTIAL);
+    CHECK(trace[2] == GHOST_FULL);
+}
+
+// ── The 8 px-wide right edge tile uses its own area, not 32×32 ───────────────
+
+static void testEdgeTileScaled()
+{
+    static_assert(DISP_W % GHOST_TILE_PX == 8, "test assumes an 8 px edge column");
+
+    std::vector<uint8_t> seq;
+    Frame f;
+    append(seq, f);
+    f.invert(DISP_W - 8, 0, 8, 32);  append(seq, f);   // 100 % of edge tile
+    f.invert(DISP_W - 8, 0, 8, 32);  append(seq, f);   // 200 % → full
+
+    std::vector<GhostRefresh> trace;
+    replayFrames(seq, &trace);
+    CHECK(trace[1] == GHOST_PARTIAL);
+    CHECK(trace[2] == GHOST_FULL);
+}
+
+// ── Invalidation (message screen in between) forces full ─────────────────────
+
+static void testInvalidate()
+{
+    Frame f;
+    ghostInvalidate();
+    ghostCommit(f.px, ghostPlan(f.px));
+    CHECK(ghostPlan(f.px) == GHOST_SKIP);
+    ghostInvalidate();
+    CHECK(ghostPlan(f.px) == GHOST_FULL);
+}
+
+int main()
+{
+    testSkipUnchanged();
+    testQuoteStripAge();
+    testTileThreshold();
+    testEdgeTileScaled();
+    testInvalidate();
+
+    return checkSummary("ghosting");
+}
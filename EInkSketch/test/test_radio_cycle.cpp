@@ -0,0 +1,216 @@
+/*
+ * test_radio_cycle.cpp — RadioCycle state machine under a virtual clock
+ * ────────────────────────────────────────────────
+ */
+
+#include "RadioCycle.h"
+#include "check.h"
+
+static float mAh(float mA, uint32_t ms) { return mA * ms / 3600000.0f; }
+
+// Mirrors RadioPolicy.cpp with a fake clock + access point
+struct Harness
+{
+    RadioCycle c;
+    uint32_t   now       = 0;
+    bool       connected = false;
+    bool       apUp      = true;
+    int        connects  = 0;
+
+    bool wake(bool reconnect = false)
+    {
+        if (radioCycleWake(c, now, connected, reconnect))
+        {
+            connects++;
+            connected = apUp;
+            radioCycleConnected(c, connected, reconnect);
+        }
+        return connected;
+    }
+
+    bool sleep(uint8_t policy, bool endCycle = true)
+    {
+        bool closed = radioCycleSleep(c, now, policy, endCycle);
+        if (c.awake == false && policy == RADIO_OFF) connected = false;
+        return closed;
+    }
+};
+
+// ── ON → DOZE → OFF: on-time and per-policy rest current ─────────────────────
+
+static void testPolicyTransitions()
+{
+    Harness h;
+
+    // Boot: radio was off, connect + fetch for 2 s, then stay on
+    CHECK(h.wake());
+    CHECK(h.connects == 1);
+    h.now += 2000;
+    CHECK(h.sleep(RADIO_ON));
+    CHECK(h.c.lastOnMs == 2000);
+    CHECK_NEAR(h.c.lastMah, mAh(RADIO_ACTIVE_MA, 2000));
+
+    // 60 s idle-associated, still connected → no reconnect; fetch 1 s, then doze
+    h.now += 60000;
+    CHECK(h.wake());
+    CHECK(h.connects == 1);
+    h.now += 1000;
+    CHECK(h.sleep(RADIO_DOZE));
+    CHECK(h.c.lastOnMs == 1000);
+    CHECK_NEAR(h.c.lastMah, mAh(RADIO_IDLE_MA, 60000) + mAh(RADIO_ACTIVE_MA, 1000));
+
+    // 60 s dozing; fetch 1 s, then off
+    h.now += 60000;
+    CHECK(h.wake());
+    CHECK(h.connects == 1);
+    h.now += 1000;
+    CHECK(h.sleep(RADIO_OFF));
+    CHECK_NEAR(h.c.lastMah, mAh(RADIO_DOZE_MA, 60000) + mAh(RADIO_ACTIVE_MA, 1000));
+
+    // 60 s off costs nothing, but the next wake must reconnect
+    h.now += 60000;
+    CHECK(h.wake());
+    CHECK(h.connects == 2);
+    h.now += 1500;
+    CHECK(h.sleep(RADIO_OFF));
+    CHECK(h.c.lastOnMs == 1500);
+    CHECK_NEAR(h.c.lastMah, mAh(RADIO_ACTIVE_MA, 1500));
+
+    // Idle-on is billed below active but above doze
+    CHECK(RADIO_DOZE_MA < RADIO_IDLE_MA && RADIO_IDLE_MA < RADIO_ACTIVE_MA);
+}
+
+// ── Failed connect: one attempt per deadline, retried at the next ─────────────
+
+static void testReconnectOnFailure()
+{
+    Harness h;
+    h.apUp = false;
+
+    CHECK(!h.wake());
+    CHECK(h.connects == 1);
+    h.now += 19000;                  // fast + full connect timeouts
+    CHECK(h.sleep(RADIO_OFF));
+    CHECK(!h.c.awake);
+    CHECK(h.c.lastOnMs == 19000);
+
+    // AP back by the next deadline → exactly one more attempt succeeds
+    h.apUp = true;
+    h.now += 300000;
+    CHECK(h.wake());
+    CHECK(h.connects == 2);
+
+    // Waking again while awake + connected does not reconnect
+    CHECK(h.wake());
+    CHECK(h.connects == 2);
+
+    // Explicit reconnect (BLE CONNECT) always does
+    CHECK(h.wake(true));
+    CHECK(h.connects == 3);
+}
+
+// ── AP down: scheduled wakes back off, reset by success or BLE CONNECT ───────
+
+static void testBackoff()
+{
+    const uint32_t interval = 10000;    // shortest mode-0 interval
+    const uint32_t cap      = 300000;   // STATIC_CHECK_MS
+    const uint32_t failMs   = 19000;    // fast + full connect timeouts
+
+    Harness  h;
+    uint32_t lastFetch = 0;
+    uint32_t delays[8];
+    h.apUp = false;
+
+    // Drive the loop() deadline logic for 8 failed wakes
+    for (int i = 0; i < 8; i++)
+    {
+        delays[i] = radioCycleDelay(h.c, interval, cap);
+        h.now = lastFetch + delays[i];
+        CHECK(!h.wake());
+        h.now += failMs;
+        h.sleep(RADIO_OFF);
+        lastFetch = h.now;
+    }
+    CHECK(h.connects == 8);
+    CHECK(delays[0] == 10000);
+    CHECK(delays[1] == 20000);
+    CHECK(delays[2] == 40000);
+    CHECK(delays[5] == 300000);
+    CHECK(delays[7] == 300000);
+
+    // Radio-on share falls well below the ~65 % of retrying every interval
+    uint32_t onTotal = 8 * failMs;
+    CHECK(onTotal * 100 / h.now < 15);
+
+    // BLE CONNECT resets the backoff even if it fails too
+    h.wake(true);
+    h.sleep(RADIO_OFF, false);
+    CHECK(radioCycleDelay(h.c, interval, cap) == interval);
+
+    // Failures again, then the AP returns: success resets the backoff
+    h.wake();
+    h.sleep(RADIO_OFF);
+    h.wake();
+    h.sleep(RADIO_OFF);
+    CHECK(radioCycleDelay(h.c, interval, cap) == 4 * interval);
+    h.apUp = true;
+    CHECK(h.wake());
+    h.sleep(RADIO_OFF);
+    CHECK(radioCycleDelay(h.c, interval, cap) == interval);
+
+    // Static modes: interval above the cap is never shortened
+    CHECK(radioCycleDelay(h.c, 600000, cap) == 600000);
+}
+
+// ── Command wakes fold into the open cycle instead of closing it ──────────────
+
+static void testCommandWakes()
+{
+    Harness h;
+    CHECK(h.wake());
+    h.now += 1000;
+    CHECK(h.sleep(RADIO_OFF));
+    CHECK(h.c.lastOnMs == 1000);
+
+    // BLE REFRESH mid-cycle: 3 s on, cycle stays open
+    h.now += 10000;
+    h.wake();
+    h.now += 3000;
+    CHECK(!h.sleep(RADIO_DOZE, false));
+    CHECK(h.c.lastOnMs == 1000);     // previous report untouched
+
+    // Scheduled fetch: cycle covers both awake spans + the doze after the command
+    h.now += 20000;
+    h.wake();
+    h.now += 2000;
+    CHECK(h.sleep(RADIO_DOZE));
+    CHECK(h.c.lastOnMs == 5000);
+    CHECK_NEAR(h.c.lastMah, mAh(RADIO_ACTIVE_MA, 5000) + mAh(RADIO_DOZE_MA, 20000));
+
+    // Sleeping twice is a no-op
+    CHECK(!h.sleep(RADIO_DOZE));
+}
+
+// ── millis() wraparound ──────────────────────────────────────────────────────
+
+static void testClockWrap()
+{
+    Harness h;
+    h.now = 0xFFFFFC18;              // 1 s before wrap
+    h.wake();
+    h.now += 2000;                   // wraps to 1000
+    CHECK(h.sleep(RADIO_OFF));
+    CHECK(h.c.lastOnMs == 2000);
+}
+
+int main()
+{
+    testPolicyTransitions();
+    testReconnectOnFailure();
+    testBackoff();
+    testCommandWakes();
+    testClockWrap();
+
+    return checkSummary("radio cycle");
+}
@@ -4,6 +4,17 @@ const { generateQuote, generateImagePrompt, generateImage } = require('../lib/ai
 const { imageToBitmap, textToBitmap, base64ToBitmap, BITMAP_BYTES } = require('../lib/imaging');
 const { writeUserLog } = require('../lib/logs');
 
+// Reconnecting from radio-off costs ~1-2 s of full-power radio time, which
+// only pays off when the radio would otherwise idle for a minute or more.
+const RADIO_OFF_MIN_IDLE_S = 60;
+const STATIC_CHECK_S = 300; // firmware re-checks static modes every 5 min
+
+function radioPolicyFor(settings) {
+  if (settings.radioPolicy >= 0) return settings.radioPolicy;
+  const idle = settings.displayMode === 0 ? settings.duration : Math.max(settings.duration, STATIC_CHECK_S);
+  return idle >= RADIO_OFF_MIN_IDLE_S ? 2 : 1;
+}
+
 module.exports = async function handler(req, res) {
   cors(res);
   if (req.method === 'OPTIONS') return res.status(200).end();
@@ -33,6 +44,7 @@ module.exports = async function handler(req, res) {
     res.setHeader('Content-Type', 'application/octet-stream');
     res.setHeader('X-Display-Mode', String(displayMode));
     res.setHeader('X-Duration', String(settings.duration));
+    res.setHeader('X-Radio-Policy', String(radioPolicyFor(settings)));
     await writeUserLog(user._id, {
       source: 'device',
       level: 'info',
@@ -127,6 +139,7 @@ module.exports = async function handler(req, res) {
     res.setHeader('Content-Type', 'application/octet-stream');
     res.setHeader('X-Display-Mode', String(displayMode));
     res.setHeader('X-Duration', String(settings.duration));
+    res.setHeader('X-Radio-Policy', String(radioPolicyFor(settings)));
     console.log(`[frame] mode=${displayMode} view=${viewType} bmp=${bitmap.length} q=${quoteBytes.length}`);
     res.send(combined);
   } catch (err) {
@@ -31,6 +31,11 @@ module.exports = async function handler(req, res) {
     if (u.displayMode !== undefined) set['settings.displayMode'] = u.displayMode;
     if (u.viewType !== undefined) set['settings.viewType'] = u.viewType;
     if (u.duration !== undefined) set['settings.duration'] = Math.max(10, Math.min(3600, u.duration));
+    if (u.radioPolicy !== undefined) {
+      const policy = Math.round(Number(u.radioPolicy));
+      if (Number.isNaN(policy)) return res.status(400).json({ error: 'radioPolicy must be -1, 0, 1 or 2' });
+      set['settings.radioPolicy'] = Math.max(-1, Math.min(2, policy));
+    }
     if (u.customQuote !== undefined) set['settings.customQuote'] = u.customQuote;
     if (u.customImage !== undefined) set['settings.customImage'] = u.customImage;
 
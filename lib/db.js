@@ -45,6 +45,10 @@ const userSchema = new mongoose.Schema({
     // Seconds between auto-refresh (only for mode 0)
     duration: { type: Number, default: 60, min: 10, max: 3600 },
 
+    // Device WiFi between fetches: 0 = stay on, 1 = modem-sleep, 2 = off
+    // -1 = auto (chosen per mode from the refresh interval)
+    radioPolicy: { type: Number, default: -1, min: -1, max: 2 },
+
     customQuote: { type: String, default: '' },
     customImage: { type: String, default: '' }, // base64 data URI
 